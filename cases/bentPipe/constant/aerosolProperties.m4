@@ -74,6 +74,8 @@ submodels
             tolerance   1E-6;
             maxIter     3;
             VMax        10.0;
+            diameters   (1E-5 2E-5 3.5E-5);
+            errorInterval 20;
         }
     }
 }
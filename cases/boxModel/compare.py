@@ -0,0 +1,54 @@
+#!/usr/bin/python
+
+import os
+import sys
+import numpy as np
+
+# Compares the probed fields of the box model in the first directory against
+# those of the uniform case in the second directory, which should have been
+# run with the same aerosol model. Reported is the maximum difference over
+# time relative to the maximum magnitude of the uniform case. Exits with a
+# non-zero status if a difference exceeds the tolerance, the optional third
+# argument, or if no field could be compared.
+
+box = os.path.join(sys.argv[1], 'postProcessing', 'probes', '0')
+ref = os.path.join(sys.argv[2], 'postProcessing', 'probes', '0')
+
+tolerance = float(sys.argv[3]) if len(sys.argv) > 3 else 1e-3
+
+print('%-24s %s' % ('field', 'relative difference'))
+
+nCompared = 0
+failed = []
+
+for field in sorted(os.listdir(box)):
+
+    if not os.path.isfile(os.path.join(ref, field)):
+        continue
+
+    a = np.atleast_2d(np.loadtxt(os.path.join(box, field)))
+    b = np.atleast_2d(np.loadtxt(os.path.join(ref, field)))
+
+    f = np.interp(a[:,0], b[:,0], b[:,1])
+
+    diff = np.max(np.abs(a[:,1]-f))/max(np.max(np.abs(b[:,1])), 1e-300)
+
+    nCompared += 1
+
+    # A NaN difference fails as well
+
+    if not diff <= tolerance:
+        failed.append(field)
+
+    print('%-24s %.6e' % (field, diff))
+
+if nCompared == 0:
+    print('No fields to compare')
+    sys.exit(1)
+
+if failed:
+    print('Relative difference above %g for: %s'
+          % (tolerance, ' '.join(failed)))
+    sys.exit(1)
+
+print('All relative differences within %g' % tolerance)
@@ -75,6 +75,8 @@ submodels
             tolerance   1E-6;
             maxIter     3;
             VMax        10.0;
+            diameters   (1E-6 1E-5 5E-5 2E-4 6E-4);
+            errorInterval 20;
         }
     }
 }
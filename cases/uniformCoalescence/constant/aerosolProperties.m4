@@ -36,6 +36,10 @@ fixedSectionalCoeffs
     }
 
     initFromPatch walls;
+
+    batchedRates VARBATCHED;
+
+    coalescenceThreshold 0;
 }
 
 submodels